@@ -6,6 +6,10 @@
 
 
 #define BATTERY_INTERVAL           60000
+/* Delay of the first measurement after join, keeps ADC work away from the
+ * first button press after power-up.
+ */
+#define BATTERY_START_DELAY        5000
 
 LOG_MODULE_REGISTER(battery, LOG_LEVEL_INF);
 
@@ -16,10 +20,39 @@ static const struct adc_dt_spec adc_channels[] = {
     DT_FOREACH_PROP_ELEM(DT_PATH(zephyr_user), io_channels, DT_SPEC_AND_COMMA)
 };
 
-void battery_alarm_handler(uint8_t)
+static bool configure_battery(void)
 {
+    int err;
+    /* Configure channels individually prior to sampling. */
+    for (size_t i = 0U; i < ARRAY_SIZE(adc_channels); i++) {
+        if (!adc_is_ready_dt(&adc_channels[i])) {
+            LOG_ERR("ADC controller device %s not ready\n", adc_channels[i].dev->name);
+            return false;
+        }
+
+        err = adc_channel_setup_dt(&adc_channels[i]);
+        if (err < 0) {
+            LOG_ERR("Could not setup channel #%d (%d)\n", i, err);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void battery_alarm_handler(uint8_t)
+{
+    static bool configured = false;
+
     ZB_SCHEDULE_APP_ALARM(battery_alarm_handler, ZB_ALARM_ANY_PARAM, ZB_MILLISECONDS_TO_BEACON_INTERVAL(BATTERY_INTERVAL));
 
+    if (!configured) {
+        /* retried on the next tick on failure */
+        configured = configure_battery();
+        if (!configured) {
+            return;
+        }
+    }
+
     int16_t buf;
     struct adc_sequence sequence = {
         .buffer = &buf,
@@ -45,20 +78,9 @@ void battery_alarm_handler(uint8_t)
     set_battery_state(val_mv, level_dp);
 }
 
-void configure_battery(void)
+void start_battery_measurement(void)
 {
-    int err;
-    /* Configure channels individually prior to sampling. */
-    for (size_t i = 0U; i < ARRAY_SIZE(adc_channels); i++) {
-        if (!adc_is_ready_dt(&adc_channels[i])) {
-            LOG_ERR("ADC controller device %s not ready\n", adc_channels[i].dev->name);
-            return;
-        }
-
-        err = adc_channel_setup_dt(&adc_channels[i]);
-        if (err < 0) {
-            LOG_ERR("Could not setup channel #%d (%d)\n", i, err);
-            return;
-        }
-    }
+    /* (re)start battery measurement timer, a rejoin must not spawn a second one */
+    ZB_SCHEDULE_APP_ALARM_CANCEL(battery_alarm_handler, ZB_ALARM_ANY_PARAM);
+    ZB_SCHEDULE_APP_ALARM(battery_alarm_handler, ZB_ALARM_ANY_PARAM, ZB_MILLISECONDS_TO_BEACON_INTERVAL(BATTERY_START_DELAY));
 }
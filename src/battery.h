@@ -1,5 +1,4 @@
 #pragma once
 
 
-void configure_battery(void);
-void battery_alarm_handler(uint8_t);
+void start_battery_measurement(void);
@@ -0,0 +1,44 @@
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include "boot_profile.h"
+
+
+LOG_MODULE_REGISTER(boot_profile, LOG_LEVEL_INF);
+
+static const char *const phase_names[BOOT_PHASE_COUNT] = {
+    [BOOT_PHASE_MAIN] = "main",
+    [BOOT_PHASE_ZIGBEE_ENABLED] = "zigbee enabled",
+    [BOOT_PHASE_STACK_STARTED] = "stack started",
+    [BOOT_PHASE_READY] = "ready",
+    [BOOT_PHASE_FIRST_PRESS] = "first press",
+    [BOOT_PHASE_FIRST_ACK] = "first ack",
+};
+
+static bool phase_recorded[BOOT_PHASE_COUNT];
+static int64_t phase_timestamps_ms[BOOT_PHASE_COUNT];
+
+/* Records time since kernel start of the first occurrence of the given
+ * phase, later calls for the same phase are ignored.
+ */
+void boot_profile_mark(enum boot_phase phase)
+{
+    if (phase_recorded[phase]) {
+        return;
+    }
+    phase_timestamps_ms[phase] = k_uptime_get();
+    phase_recorded[phase] = true;
+    LOG_INF("boot phase '%s' at %lld ms", phase_names[phase], (long long)phase_timestamps_ms[phase]);
+
+    if (phase == BOOT_PHASE_FIRST_ACK && phase_recorded[BOOT_PHASE_FIRST_PRESS]) {
+        LOG_INF("first press acknowledged after %lld ms",
+            (long long)(phase_timestamps_ms[BOOT_PHASE_FIRST_ACK] - phase_timestamps_ms[BOOT_PHASE_FIRST_PRESS]));
+    }
+}
+
+int64_t boot_profile_get_ms(enum boot_phase phase)
+{
+    if (!phase_recorded[phase]) {
+        return 0;
+    }
+    return phase_timestamps_ms[phase];
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include <stdint.h>
+
+
+enum boot_phase {
+    BOOT_PHASE_MAIN,            /* main() entered */
+    BOOT_PHASE_ZIGBEE_ENABLED,  /* zigbee thread started */
+    BOOT_PHASE_STACK_STARTED,   /* zigbee stack signalled skip startup */
+    BOOT_PHASE_READY,           /* rejoined or joined, ready to send */
+    BOOT_PHASE_FIRST_PRESS,     /* first scene command requested */
+    BOOT_PHASE_FIRST_ACK,       /* first scene command acknowledged */
+    BOOT_PHASE_COUNT,
+};
+
+void boot_profile_mark(enum boot_phase phase);
+int64_t boot_profile_get_ms(enum boot_phase phase);
@@ -2,17 +2,21 @@
 #include <zephyr/logging/log.h>
 
 #include "zigbee.h"
-#include "battery.h"
+#include "boot_profile.h"
 
 
 LOG_MODULE_REGISTER(app, LOG_LEVEL_INF);
 
 int main(void)
 {
+    boot_profile_mark(BOOT_PHASE_MAIN);
     LOG_INF("Starting Zigbee R23 Scene Switch");
 
-    configure_battery();
+    /* Battery ADC is configured lazily on the first measurement, which is
+     * deferred until after the network is joined, see battery.c.
+     */
     configure_zigbee();
+    boot_profile_mark(BOOT_PHASE_ZIGBEE_ENABLED);
 
     LOG_INF("Zigbee R23 Scene Switch started");
 
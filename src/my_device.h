@@ -1,3 +1,23 @@
+/* Manufacturer code of the project specific attributes. There is no code
+ * assigned to this project, 0xFFF1 is one of the codes reserved for testing.
+ */
+#define MY_DEVICE_MANUF_CODE 0xFFF1
+
+/* Time from kernel start until the device is ready to send, in milliseconds.
+ * Manufacturer specific, read only attribute of the basic cluster, it is not
+ * defined by ZCL.
+ */
+#define MY_DEVICE_ATTR_BOOT_READY_TIME_ID 0x0100
+
+#define ZB_SET_ATTR_DESCR_WITH_MY_DEVICE_ATTR_BOOT_READY_TIME_ID(data_ptr)    \
+{                                                                             \
+    MY_DEVICE_ATTR_BOOT_READY_TIME_ID,                                        \
+    ZB_ZCL_ATTR_TYPE_U32,                                                     \
+    ZB_ZCL_ATTR_ACCESS_READ_ONLY | ZB_ZCL_ATTR_MANUF_SPEC,                    \
+    MY_DEVICE_MANUF_CODE,                                                     \
+    (void*) data_ptr                                                          \
+}
+
 #define ZB_HA_DECLARE_MY_DEVICE_CLUSTER_LIST(                                   \
       cluster_list_name,                                                        \
       basic_attr_list,                                                          \
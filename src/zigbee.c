@@ -1,5 +1,6 @@
 #include "led.h"
 #include "battery.h"
+#include "boot_profile.h"
 #include "my_device.h"
 #include <zephyr/logging/log.h>
 #define ZB_HA_DEFINE_DEVICE_SCENE_SELECTOR
@@ -33,26 +34,30 @@ zb_uint8_t g_attr_basic_power_source = ZB_ZCL_BASIC_POWER_SOURCE_BATTERY;
 zb_char_t g_attr_basic_location_description[] = ZB_ZCL_BASIC_LOCATION_DESCRIPTION_DEFAULT_VALUE;
 zb_uint8_t g_attr_basic_physical_environment = ZB_ZCL_BASIC_PHYSICAL_ENVIRONMENT_DEFAULT_VALUE;
 zb_char_t g_attr_sw_build_id[] = "\x07" "9dff6ce";
+zb_bool_t g_attr_basic_device_enabled = ZB_TRUE;
+zb_uint32_t g_attr_basic_boot_ready_time = 0;
 
 /* Define 'bat_num' as empty in order to declare default battery set attributes. */
 /* According to Table 3-17 of ZCL specification, defining 'bat_num' as 2 or 3 allows */
 /* to declare battery set attributes for BATTERY2 and BATTERY3 */
 #define bat_num
 
-ZB_ZCL_DECLARE_BASIC_ATTRIB_LIST_EXT(
-    basic_attr_list,
-    &g_attr_basic_zcl_version,
-    &g_attr_basic_application_version,
-    &g_attr_basic_stack_version,
-    &g_attr_basic_hw_version,
-    &g_attr_basic_manufacturer_name,
-    &g_attr_basic_model_identifier,
-    &g_attr_basic_date_code,
-    &g_attr_basic_power_source,
-    &g_attr_basic_location_description,
-    &g_attr_basic_physical_environment,
-    &g_attr_sw_build_id
-);
+/* Same as ZB_ZCL_DECLARE_BASIC_ATTRIB_LIST_EXT, extended with the boot ready time attribute */
+ZB_ZCL_START_DECLARE_ATTRIB_LIST_CLUSTER_REVISION(basic_attr_list, ZB_ZCL_BASIC)
+ZB_ZCL_SET_ATTR_DESC(ZB_ZCL_ATTR_BASIC_ZCL_VERSION_ID, &g_attr_basic_zcl_version)
+ZB_ZCL_SET_ATTR_DESC(ZB_ZCL_ATTR_BASIC_APPLICATION_VERSION_ID, &g_attr_basic_application_version)
+ZB_ZCL_SET_ATTR_DESC(ZB_ZCL_ATTR_BASIC_STACK_VERSION_ID, &g_attr_basic_stack_version)
+ZB_ZCL_SET_ATTR_DESC(ZB_ZCL_ATTR_BASIC_HW_VERSION_ID, &g_attr_basic_hw_version)
+ZB_ZCL_SET_ATTR_DESC(ZB_ZCL_ATTR_BASIC_MANUFACTURER_NAME_ID, &g_attr_basic_manufacturer_name)
+ZB_ZCL_SET_ATTR_DESC(ZB_ZCL_ATTR_BASIC_MODEL_IDENTIFIER_ID, &g_attr_basic_model_identifier)
+ZB_ZCL_SET_ATTR_DESC(ZB_ZCL_ATTR_BASIC_DATE_CODE_ID, &g_attr_basic_date_code)
+ZB_ZCL_SET_ATTR_DESC(ZB_ZCL_ATTR_BASIC_POWER_SOURCE_ID, &g_attr_basic_power_source)
+ZB_ZCL_SET_ATTR_DESC(ZB_ZCL_ATTR_BASIC_LOCATION_DESCRIPTION_ID, &g_attr_basic_location_description)
+ZB_ZCL_SET_ATTR_DESC(ZB_ZCL_ATTR_BASIC_PHYSICAL_ENVIRONMENT_ID, &g_attr_basic_physical_environment)
+ZB_ZCL_SET_ATTR_DESC(ZB_ZCL_ATTR_BASIC_SW_BUILD_ID, &g_attr_sw_build_id)
+ZB_ZCL_SET_ATTR_DESC(ZB_ZCL_ATTR_BASIC_DEVICE_ENABLED_ID, &g_attr_basic_device_enabled)
+ZB_ZCL_SET_ATTR_DESC(MY_DEVICE_ATTR_BOOT_READY_TIME_ID, &g_attr_basic_boot_ready_time)
+ZB_ZCL_FINISH_DECLARE_ATTRIB_LIST;
 
 /* Identify cluster attributes data */
 zb_uint16_t g_attr_identify_identify_time = ZB_ZCL_IDENTIFY_IDENTIFY_TIME_DEFAULT_VALUE;
@@ -118,6 +123,7 @@ static void scene_callback(zb_bufid_t buffer)
     }
     else {
         blink_state_led(200, 0, 0);
+        boot_profile_mark(BOOT_PHASE_FIRST_ACK);
     }
     /* Free the buffer */
     zb_buf_free(buffer);
@@ -149,6 +155,7 @@ void send_scene(uint16_t scene_id)
     if (scene_id == 0) {
         return;
     }
+    boot_profile_mark(BOOT_PHASE_FIRST_PRESS);
 
     g_scene_failed = ZB_FALSE;
     g_scene_id = scene_id;
@@ -159,6 +166,24 @@ void send_scene(uint16_t scene_id)
     }
 }
 
+static void set_boot_ready_time(void)
+{
+    int64_t ready_ms = boot_profile_get_ms(BOOT_PHASE_READY);
+    zb_uint32_t boot_ready_time = ready_ms > UINT32_MAX ? UINT32_MAX : (zb_uint32_t)ready_ms;
+    if (zb_zcl_set_attr_val_manuf(
+            MY_DEVICE_ENDPOINT,
+            ZB_ZCL_CLUSTER_ID_BASIC,
+            ZB_ZCL_CLUSTER_SERVER_ROLE,
+            MY_DEVICE_ATTR_BOOT_READY_TIME_ID,
+            MY_DEVICE_MANUF_CODE,
+            (zb_uint8_t *)&boot_ready_time,
+            ZB_FALSE
+        ))
+    {
+        LOG_ERR("Failed to set ZCL attribute");
+    }
+}
+
 static void join_status_led(zb_uint8_t interval_s)
 {
     ZB_SCHEDULE_APP_ALARM(join_status_led, interval_s, ZB_SECONDS_TO_BEACON_INTERVAL(interval_s));
@@ -178,13 +203,19 @@ void zboss_signal_handler(zb_bufid_t bufid)
     LOG_INF("ZBOSS signal handler, sig: %d, status: %d, joined: %d", sig, status, ZB_JOINED());
 
     switch (sig) {
+    case ZB_ZDO_SIGNAL_SKIP_STARTUP:
+        boot_profile_mark(BOOT_PHASE_STACK_STARTED);
+        /* Call default signal handler. */
+        ZB_ERROR_CHECK(zigbee_default_signal_handler(bufid));
+        break;
     case ZB_BDB_SIGNAL_DEVICE_REBOOT:
     /* fall-through */
     case ZB_BDB_SIGNAL_STEERING:
         if (status == RET_OK) {
+            boot_profile_mark(BOOT_PHASE_READY);
+            set_boot_ready_time();
             blink_state_led(200, 0, 0);
-            /* start battery measurement timer */
-            ZB_SCHEDULE_APP_CALLBACK(battery_alarm_handler, ZB_ALARM_ANY_PARAM);
+            start_battery_measurement();
             // TODO: greater values here do not play nice with zigbee2mqtt, should it be nogotiated or smth ? 
             zb_zdo_pim_set_long_poll_interval(900000);
             uint32_t channel_mask = 1 << zb_get_current_channel();